@@ -1,6 +1,13 @@
 #include <emscripten/bind.h>
+#include <emscripten/val.h>
 #include "csv_converter.h"
 
+// JS 배열(문자열 배열 2개)을 받아 일괄 변환 함수로 전달
+static std::string convertBatchToJsonJS(emscripten::val csvContents, emscripten::val filenames) {
+    return convertBatchToJson(emscripten::vecFromJSArray<std::string>(csvContents),
+                              emscripten::vecFromJSArray<std::string>(filenames));
+}
+
 // =================================================================================
 // Emscripten Bindings
 // =================================================================================
@@ -8,4 +15,5 @@
 
 EMSCRIPTEN_BINDINGS(csv_converter_bindings) {
     emscripten::function("convertToJsonOptimized", &convertToJsonOptimized);
+    emscripten::function("convertBatchToJson", &convertBatchToJsonJS);
 }
\ No newline at end of file
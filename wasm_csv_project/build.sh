@@ -21,9 +21,13 @@ fi
 
 # Parse arguments
 BUILD_TYPE="release"
-if [ "$1" == "debug" ] || [ "$1" == "-d" ]; then
-    BUILD_TYPE="debug"
-fi
+USE_THREADS=0
+for arg in "$@"; do
+    case $arg in
+        debug|-d) BUILD_TYPE="debug" ;;
+        threads|-t) USE_THREADS=1 ;;
+    esac
+done
 
 # Clean previous build files
 echo ""
@@ -35,8 +39,10 @@ echo "✓ Cleaned"
 SOURCE_FILES=(
     csv_lib/csv_converter.cpp
     csv_lib/type_checker.cpp
+    csv_lib/date_parser.cpp
     csv_lib/csv_utils.cpp
     csv_lib/csv_parser.cpp
+    csv_lib/thread_pool.cpp
     bindings.cpp
 )
 
@@ -45,7 +51,6 @@ COMMON_FLAGS=(
     -s WASM=1
     -s MODULARIZE=0
     -s EXPORT_ES6=0
-    -s ENVIRONMENT='web'
     -s ALLOW_MEMORY_GROWTH=1
     -s MAXIMUM_MEMORY=4GB
     -s INITIAL_MEMORY=256MB
@@ -58,6 +63,20 @@ COMMON_FLAGS=(
     -std=c++17
 )
 
+# Multi-threaded build (worker pool for convertBatchToJson)
+# Requires the page to be served with COOP/COEP headers (SharedArrayBuffer)
+if [ $USE_THREADS -eq 1 ]; then
+    COMMON_FLAGS+=(
+        -pthread
+        -s ENVIRONMENT='web,worker'
+        -s PTHREAD_POOL_SIZE=navigator.hardwareConcurrency
+    )
+else
+    COMMON_FLAGS+=(
+        -s ENVIRONMENT='web'
+    )
+fi
+
 # Build release version with maximum performance optimizations
 build_release() {
     echo ""
@@ -94,6 +113,7 @@ build_release() {
         echo "  • convertToJson() - Standard conversion"
         echo "  • convertToJsonAuto() - Auto-select based on size"
         echo "  • convertToJsonOptimized() - Optimized algorithm"
+        echo "  • convertBatchToJson() - Batch conversion of multiple files"
         return 0
     else
         echo "✗ Release build failed with closure compiler"
@@ -159,6 +179,7 @@ echo ""
 echo "Usage:"
 echo "  ./build.sh        # Build release version (maximum performance optimizations)"
 echo "  ./build.sh debug  # Build debug version (for development)"
+echo "  ./build.sh threads # Build multi-threaded version (needs COOP/COEP headers)"
 echo ""
 echo "To test, start a local server:"
 echo "  python3 -m http.server 8080"
@@ -392,6 +392,27 @@ function initializeStatsSection() {
   }
 }
 
+// 날짜/시간 컬럼 이름 -> 타입 (date, datetime, time) 맵을 메타데이터에서 생성
+function getTemporalColumnTypes() {
+  const temporalTypes = {};
+  if (convertedJsonData && convertedJsonData.metadata && convertedJsonData.metadata.columns) {
+    convertedJsonData.metadata.columns.forEach((col) => {
+      if (col.type === "date" || col.type === "datetime" || col.type === "time") {
+        temporalTypes[col.name] = col.type;
+      }
+    });
+  }
+  return temporalTypes;
+}
+
+// 날짜/시간 컬럼은 epoch 밀리초(UTC)로 전달되므로 표시용 문자열로 변환
+function formatTemporal(value, type) {
+  const iso = new Date(value).toISOString();
+  if (type === "date") return iso.slice(0, 10);
+  if (type === "time") return iso.slice(11, 19);
+  return iso.slice(0, 19).replace("T", " ");
+}
+
 function renderDataTable() {
   const tableHead = document.getElementById("stats-table-head");
   const tableBody = document.getElementById("stats-table-body");
@@ -412,6 +433,7 @@ function renderDataTable() {
 
   // Get column names from first data row
   const columns = Object.keys(data[0]);
+  const temporalTypes = getTemporalColumnTypes();
 
   // Create table header (가로줄 = 컬럼명)
   const headerRow = document.createElement("tr");
@@ -476,8 +498,13 @@ function renderDataTable() {
 
       const value = data[i][colName];
       // Handle null, undefined, or empty values
-      td.textContent =
-        value === null || value === undefined || value === "" ? "-" : value;
+      if (value === null || value === undefined || value === "") {
+        td.textContent = "-";
+      } else if (temporalTypes[colName] && typeof value === "number") {
+        td.textContent = formatTemporal(value, temporalTypes[colName]);
+      } else {
+        td.textContent = value;
+      }
 
       row.appendChild(td);
     });
@@ -673,10 +700,16 @@ function applyFilterToColumn(columnName) {
     return;
   }
 
+  // 날짜/시간 컬럼은 변환된 epoch 값(숫자)만 사용하고 결과를 날짜로 표시
+  const temporalType = getTemporalColumnTypes()[columnName];
+  const formatValue = (v) =>
+    temporalType ? formatTemporal(Math.round(v), temporalType) : v.toLocaleString();
+
   const data = convertedJsonData.data;
   const values = data
     .map((row) => {
       const val = row[columnName];
+      if (temporalType) return typeof val === "number" ? val : null;
       return val !== null && val !== undefined && val !== ""
         ? parseFloat(val)
         : null;
@@ -692,14 +725,16 @@ function applyFilterToColumn(columnName) {
 
   if (activeFilter === "max") {
     const maxValue = Math.max(...values);
-    resultText = `"${columnName}" 열의 최대값: ${maxValue.toLocaleString()}`;
+    resultText = `"${columnName}" 열의 최대값: ${formatValue(maxValue)}`;
   } else if (activeFilter === "min") {
     const minValue = Math.min(...values);
-    resultText = `"${columnName}" 열의 최소값: ${minValue.toLocaleString()}`;
+    resultText = `"${columnName}" 열의 최소값: ${formatValue(minValue)}`;
   } else if (activeFilter === "avg") {
     const sum = values.reduce((a, b) => a + b, 0);
     const avg = sum / values.length;
-    resultText = `"${columnName}" 열의 평균: ${avg.toFixed(2)}`;
+    resultText = `"${columnName}" 열의 평균: ${
+      temporalType ? formatValue(avg) : avg.toFixed(2)
+    }`;
   } else if (activeFilter === "stats") {
     const maxValue = Math.max(...values);
     const minValue = Math.min(...values);
@@ -707,9 +742,9 @@ function applyFilterToColumn(columnName) {
     const avg = sum / values.length;
     const count = values.length;
 
-    resultText = `"${columnName}" 열의 통계 - 개수: ${count.toLocaleString()}, 최소값: ${minValue.toLocaleString()}, 최대값: ${maxValue.toLocaleString()}, 평균: ${avg.toFixed(
-      2
-    )}`;
+    resultText = `"${columnName}" 열의 통계 - 개수: ${count.toLocaleString()}, 최소값: ${formatValue(minValue)}, 최대값: ${formatValue(maxValue)}, 평균: ${
+      temporalType ? formatValue(avg) : avg.toFixed(2)
+    }`;
   }
 
   showStatsResult(resultText);
@@ -1060,7 +1095,14 @@ function renderChart() {
 
   if (!labelCol || !dataCol) return;
 
-  const labels = convertedJsonData.data.map((row) => row[labelCol]);
+  // 날짜/시간 컬럼을 레이블로 쓰면 epoch 값을 날짜 문자열로 변환
+  const labelTemporalType = getTemporalColumnTypes()[labelCol];
+  const labels = convertedJsonData.data.map((row) => {
+    const value = row[labelCol];
+    return labelTemporalType && typeof value === "number"
+      ? formatTemporal(value, labelTemporalType)
+      : value;
+  });
   const data = convertedJsonData.data.map((row) => row[dataCol]);
   const styleHeight = chartCanvas.style.height;
 
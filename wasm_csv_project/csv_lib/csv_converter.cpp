@@ -7,13 +7,20 @@
 #include <algorithm>
 #include <cmath>
 #include <unordered_set>
+#include <unordered_map>
+#include <functional>
+#include <mutex>
 #include <iomanip>
+#include <cstdlib>
+#include <cerrno>
 
 #include "csv_types.h"
 #include "type_checker.h"
 #include "csv_utils.h"
 #include "csv_parser.h"
+#include "date_parser.h"
 #include "csv_converter.h"
+#include "thread_pool.h"
 
 using namespace std;
 using namespace emscripten;
@@ -25,6 +32,8 @@ static string dataTypeToString(DataType type) {
         case DataType::FLOAT:   return "float";
         case DataType::BOOLEAN: return "boolean";
         case DataType::DATE:    return "date";
+        case DataType::DATETIME: return "datetime";
+        case DataType::TIME:    return "time";
         case DataType::STRING:  return "string";
     }
     return "string";
@@ -55,12 +64,57 @@ static double getStdDev(const ColumnStats& stats) {
     return stats.count > 1 ? sqrt(stats.m2 / (stats.count - 1)) : NAN;
 }
 
+// 부분 통계 두 개를 하나로 병합하는 함수 (Chan et al.의 병렬 분산 공식 사용)
+static void mergeStats(ColumnStats& into, const ColumnStats& from) {
+    into.nullCount += from.nullCount;
+    into.minLength = min(into.minLength, from.minLength);
+    into.maxLength = max(into.maxLength, from.maxLength);
+
+    if (from.count == 0) return;
+    if (into.count == 0) {
+        into.min = from.min;
+        into.max = from.max;
+        into.sum = from.sum;
+        into.mean = from.mean;
+        into.m2 = from.m2;
+        into.count = from.count;
+        return;
+    }
+
+    double total = (double)into.count + from.count;
+    double delta = from.mean - into.mean;
+    into.min = min(into.min, from.min);
+    into.max = max(into.max, from.max);
+    into.sum += from.sum;
+    into.mean += delta * from.count / total;
+    into.m2 += from.m2 + delta * delta * into.count * from.count / total;
+    into.count += from.count;
+}
+
+// 날짜/시간 계열 타입인지 확인 (epoch 밀리초로 저장되는 타입)
+static bool isTemporalType(DataType type) {
+    return type == DataType::DATE || type == DataType::DATETIME || type == DataType::TIME;
+}
+
+// 두 타입을 모두 표현할 수 있는 가장 넓은 타입 (INTEGER < FLOAT < STRING, DATE < DATETIME < STRING)
+static DataType widenType(DataType a, DataType b) {
+    if (a == b) return a;
+    bool aNumeric = (a == DataType::INTEGER || a == DataType::FLOAT);
+    bool bNumeric = (b == DataType::INTEGER || b == DataType::FLOAT);
+    if (aNumeric && bNumeric) return DataType::FLOAT;
+    bool aDate = (a == DataType::DATE || a == DataType::DATETIME);
+    bool bDate = (b == DataType::DATE || b == DataType::DATETIME);
+    if (aDate && bDate) return DataType::DATETIME;
+    return DataType::STRING;
+}
+
 // 주어진 값들의 샘플을 기반으로 컬럼의 데이터 타입을 추론하는 함수
 static DataType detectColumnType(const vector<string>& values) {
     bool isColumnInteger = true;
     bool isColumnFloat = true;
     bool isColumnBoolean = true;
     bool isColumnDate = true;
+    DataType dateType = DataType::DATE; // 날짜 컬럼일 경우 세부 타입 (DATE, DATETIME, TIME)
     int nonNullCount = 0;
 
     for (const auto& val : values) {
@@ -79,7 +133,17 @@ static DataType detectColumnType(const vector<string>& values) {
         }
 
         if (isColumnBoolean && !TypeChecker::isBoolean(val)) isColumnBoolean = false;
-        if (isColumnDate && !TypeChecker::isDate(val)) isColumnDate = false;
+        if (isColumnDate) {
+            int64_t epochMillis;
+            DataType valueType;
+            if (!parseDateTime(val, epochMillis, valueType)) {
+                isColumnDate = false;
+            } else {
+                // 날짜와 날짜+시간이 섞이면 DATETIME, 시간만 있는 값과 섞이면 날짜 컬럼 아님
+                dateType = (nonNullCount == 1) ? valueType : widenType(dateType, valueType);
+                if (dateType == DataType::STRING) isColumnDate = false;
+            }
+        }
 
         if (!isColumnInteger && !isColumnFloat && !isColumnBoolean && !isColumnDate) break;
     }
@@ -87,7 +151,7 @@ static DataType detectColumnType(const vector<string>& values) {
     // 우선순위에 따라 타입 결정 (Boolean > Date > Integer > Float > String)
     if (nonNullCount == 0) return DataType::STRING;
     if (isColumnBoolean) return DataType::BOOLEAN;
-    if (isColumnDate) return DataType::DATE;
+    if (isColumnDate) return dateType;
     if (isColumnInteger) return DataType::INTEGER;
     if (isColumnFloat) return DataType::FLOAT;
     return DataType::STRING;
@@ -106,178 +170,518 @@ static void jsonSafeDouble(ostringstream& json, double value) {
     json << fixed << setprecision(2); 
 }
 
-// CSV 내용을 최적화된 방식으로 JSON으로 변환하는 메인 함수
-string convertToJsonOptimized(const string& csvContent, const string& filename) {
+// 정제된 숫자 문자열을 double로 변환 (예외 없이 실패 여부 반환)
+static bool parseNumber(const string& str, double& value) {
+    if (str.empty()) return false;
+    const char* start = str.c_str();
+    char* end = nullptr;
+    errno = 0;
+    value = strtod(start, &end);
+    return end != start && *end == '\0' && errno != ERANGE;
+}
+
+// 한 파일 안에서 행을 나누어 처리하는 단위 (행 개수)
+static const int CHUNK_ROWS = 4096;
+// 고유값 해시 저장 최대 개수 (메모리 보호)
+static const size_t UNIQUE_HASH_LIMIT = 50000;
+// 날짜/시간 컬럼 히스토그램 구간 수
+static const int HISTOGRAM_BINS = 20;
+
+// 청크(행 구간) 하나의 처리 결과
+struct ChunkResult {
+    vector<ColumnStats> stats;
+    vector<vector<int64_t>> dateValues; // 날짜/시간 컬럼의 epoch 밀리초 값 (히스토그램 계산용)
+    string json;                        // 이 청크에 해당하는 data 배열 조각
+};
+
+// 파일 하나의 변환 상태
+struct FileJob {
+    const string* csvContent = nullptr; // 원본 CSV 내용 (호출자 소유)
+    string filename;
+    size_t fileSizeBytes = 0;
+    uint32_t numRows = 0;
+    CSVParseResult parsed;
+    vector<DataType> columnTypes;
+    vector<bool> hasSampleValues;       // 샘플에 NULL이 아닌 값이 있었는지 (타입 통합 시 사용)
+    vector<string> escapedHeaders;
+    vector<ColumnStats> stats;
+    mutex uniqueLock;                   // 청크 작업이 uniqueValHashes에 병합할 때 사용
+    vector<unordered_set<size_t>> uniqueValHashes;
+    vector<vector<vector<int64_t>>> dateValues; // 컬럼별 청크 단위 epoch 밀리초 값 (복사 없이 보관)
+    vector<ChunkResult> chunks;
+};
+
+// 고유값 해시 집합 병합 (최대 개수 제한 유지)
+template <typename HashContainer>
+static void mergeUniqueHashes(unordered_set<size_t>& into, const HashContainer& from) {
+    for (size_t h : from) {
+        if (into.size() >= UNIQUE_HASH_LIMIT) break;
+        into.insert(h);
+    }
+}
+
+// 1단계: BOM 제거, 파싱, 샘플 기반 타입 감지
+static void prepareFile(FileJob& job) {
     // BOM 제거 및 줄바꿈 정규화
-    string content = removeBOM(csvContent);
+    string content = removeBOM(*job.csvContent);
     content = normalizeLineEndings(content);
+    job.fileSizeBytes = content.length();
 
     // CSV 파싱 실행
-    CSVParseResult parsed = parseCSV(content); 
+    job.parsed = parseCSV(content);
 
-    vector<string>& headers = parsed.headers;
-    vector<vector<string>>& rows = parsed.rows;
-    char delimiter = parsed.delimiter;
-    
-    if (headers.empty()) {
-        return "{\"error\":\"Empty CSV\",\"metadata\":{\"filename\":\"" + escapeJson(filename) + "\"}}";
-    }
+    vector<string>& headers = job.parsed.headers;
+    vector<vector<string>>& rows = job.parsed.rows;
+    if (headers.empty()) return;
 
     const int numColumns = headers.size();
-    int numRows = rows.size();
+    const int numRows = rows.size();
+    job.numRows = numRows;
 
     for (auto& row : rows) {
         row.resize(numColumns);
     }
 
-    // 통계 및 타입 감지를 위한 변수 초기화
-    vector<DataType> columnTypes(numColumns);
-    vector<ColumnStats> stats(numColumns);
-    vector<unordered_set<size_t>> uniqueValHashes(numColumns);
-    hash<string> stringHasher;
+    // 샘플링: 데이터 타입 감지를 위해 최대 1000행까지 샘플링
+    int sampleSize = min(numRows, 1000);
+    job.columnTypes.resize(numColumns);
+    job.hasSampleValues.assign(numColumns, false);
+
+    vector<string> sampleData;
+    sampleData.reserve(sampleSize);
+    for (int c = 0; c < numColumns; c++) {
+        sampleData.clear();
+        for (int r = 0; r < sampleSize; r++) {
+            const string& val = rows[r][c];
+            if (!job.hasSampleValues[c] && !TypeChecker::isNull(val)) job.hasSampleValues[c] = true;
+            sampleData.push_back(val);
+        }
+        job.columnTypes[c] = detectColumnType(sampleData);
+    }
 
+    // 고유값 해시는 청크 작업이 끝날 때마다 파일 단위 집합에 바로 병합
+    job.uniqueValHashes.assign(numColumns, unordered_set<size_t>());
     for (int i = 0; i < numColumns; i++) {
-        uniqueValHashes[i].reserve(min(numRows, 10000));
+        job.uniqueValHashes[i].reserve(min(numRows, 10000));
     }
 
-    // 1. 샘플링: 데이터 타입 감지를 위해 최대 1000행까지 샘플링
-    int sampleSize = min(numRows, 1000);
-    vector<vector<string>> sampleData(numColumns);
+    // 헤더 이스케이프 미리 처리
+    job.escapedHeaders.resize(numColumns);
     for (int i = 0; i < numColumns; i++) {
-        sampleData[i].reserve(sampleSize);
+        job.escapedHeaders[i] = escapeJson(headers[i]);
     }
 
-    for (int r = 0; r < sampleSize && r < numRows; r++) {
-        for (int c = 0; c < numColumns; c++) {
-            sampleData[c].push_back(rows[r][c]);
+    job.chunks.resize((numRows + CHUNK_ROWS - 1) / CHUNK_ROWS);
+}
+
+// 여러 파일에 같은 이름의 컬럼이 있으면 가장 넓은 타입으로 통일
+static void unifyColumnTypes(vector<FileJob>& jobs) {
+    unordered_map<string, DataType> unifiedTypes;
+
+    for (const auto& job : jobs) {
+        for (size_t c = 0; c < job.columnTypes.size(); c++) {
+            // 샘플이 전부 NULL인 컬럼은 타입 정보가 없으므로 통합에 참여하지 않음
+            if (!job.hasSampleValues[c]) continue;
+            const string& name = job.parsed.headers[c];
+            auto it = unifiedTypes.find(name);
+            if (it == unifiedTypes.end()) {
+                unifiedTypes.emplace(name, job.columnTypes[c]);
+            } else {
+                it->second = widenType(it->second, job.columnTypes[c]);
+            }
         }
     }
 
-    // 2. 타입 감지: 샘플 데이터를 바탕으로 각 컬럼의 타입 결정
-    for (int i = 0; i < numColumns; i++) {
-        columnTypes[i] = detectColumnType(sampleData[i]);
-        stats[i].type = columnTypes[i];
+    for (auto& job : jobs) {
+        for (size_t c = 0; c < job.columnTypes.size(); c++) {
+            // 샘플이 전부 NULL인 컬럼은 이후 값을 알 수 없으므로 STRING 유지
+            if (!job.hasSampleValues[c]) continue;
+            auto it = unifiedTypes.find(job.parsed.headers[c]);
+            if (it != unifiedTypes.end()) job.columnTypes[c] = it->second;
+        }
     }
+}
+
+// 2단계: 청크 하나의 데이터 정제, 통계 계산, JSON 조각 작성
+static void processChunk(FileJob& job, size_t chunkIndex) {
+    vector<vector<string>>& rows = job.parsed.rows;
+    const vector<DataType>& columnTypes = job.columnTypes;
+    const int numColumns = columnTypes.size();
+    const int numRows = rows.size();
+    const int begin = chunkIndex * CHUNK_ROWS;
+    const int end = min(numRows, begin + CHUNK_ROWS);
+
+    ChunkResult& chunk = job.chunks[chunkIndex];
+    chunk.stats.assign(numColumns, ColumnStats());
+    chunk.dateValues.assign(numColumns, vector<int64_t>());
+    for (int c = 0; c < numColumns; c++) {
+        chunk.stats[c].type = columnTypes[c];
+        if (isTemporalType(columnTypes[c])) chunk.dateValues[c].reserve(end - begin);
+    }
+    hash<string> stringHasher;
 
-    // 3. 전체 데이터 순회: 데이터 정제 및 통계 계산
-    for (int r = 0; r < numRows; r++) {
+    // 고유값 해시는 청크 안에서 평면 배열로만 모으고, 이미 최대 개수에 도달한 컬럼은 건너뜀
+    vector<vector<size_t>> chunkHashes(numColumns);
+    vector<char> collectHashes(numColumns);
+    {
+        lock_guard<mutex> guard(job.uniqueLock);
         for (int c = 0; c < numColumns; c++) {
-            const string& originalVal = rows[r][c];
-            string val = originalVal;
+            collectHashes[c] = job.uniqueValHashes[c].size() < UNIQUE_HASH_LIMIT;
+            if (collectHashes[c]) chunkHashes[c].reserve(end - begin);
+        }
+    }
+
+    // 현재 행의 숫자/날짜 변환 결과 (JSON 작성 시 다시 파싱하지 않도록 보관)
+    vector<double> rowNumbers(numColumns);
+    vector<int64_t> rowEpochs(numColumns);
+    vector<char> rowParsed(numColumns);
+
+    ostringstream json;
+    json << fixed << setprecision(2);
+
+    for (int r = begin; r < end; r++) {
+        vector<string>& row = rows[r];
 
+        // 데이터 정제 및 통계 계산
+        for (int c = 0; c < numColumns; c++) {
             // 숫자 타입인 경우 문자열 정제 (예: "1,000" -> "1000")
             if (columnTypes[c] == DataType::INTEGER || columnTypes[c] == DataType::FLOAT) {
-                rows[r][c] = cleanNumericString(originalVal); 
-                val = rows[r][c]; 
+                row[c] = cleanNumericString(row[c]);
             }
+            const string& val = row[c];
+            rowParsed[c] = 0;
 
             // NULL 체크 및 카운트
             if (TypeChecker::isNull(val)) {
-                stats[c].nullCount++;
+                chunk.stats[c].nullCount++;
                 continue;
             }
 
-            // 고유값 해시 저장 (메모리 보호를 위해 최대 개수 제한)
-            if (uniqueValHashes[c].size() < 50000) {
-                uniqueValHashes[c].insert(stringHasher(val));
+            // 고유값 해시 저장 (최대 개수 제한은 파일 단위 집합에 병합할 때 적용)
+            if (collectHashes[c]) {
+                chunkHashes[c].push_back(stringHasher(val));
             }
 
+            // 문자열 길이는 모든 타입에서 기록 (전체 통계에서 타입이 STRING으로 넓어질 때 사용)
+            uint32_t len = val.length();
+            chunk.stats[c].minLength = min(chunk.stats[c].minLength, len);
+            chunk.stats[c].maxLength = max(chunk.stats[c].maxLength, len);
+
             // 타입별 통계 갱신
+            // 샘플 이후에 타입에 맞지 않는 값이 나오면 문자열 그대로 출력하고 통계에서 제외
             if (columnTypes[c] == DataType::INTEGER || columnTypes[c] == DataType::FLOAT) {
-                double num = stod(val);
-                if (!isnan(num)) {
-                    addNumericValue(stats[c], num);
+                if (parseNumber(val, rowNumbers[c]) && !isnan(rowNumbers[c])) {
+                    rowParsed[c] = 1;
+                    addNumericValue(chunk.stats[c], rowNumbers[c]);
+                }
+            } else if (isTemporalType(columnTypes[c])) {
+                // 컬럼 타입보다 넓은 값(예: DATE 컬럼의 시간, TIME 컬럼의 날짜)은 같은 epoch 축이 아니므로 제외
+                DataType valueType;
+                if (parseDateTime(val, rowEpochs[c], valueType) &&
+                    widenType(columnTypes[c], valueType) == columnTypes[c]) {
+                    rowParsed[c] = 1;
+                    chunk.dateValues[c].push_back(rowEpochs[c]);
+                    addNumericValue(chunk.stats[c], (double)rowEpochs[c]);
                 }
-            } else if (columnTypes[c] == DataType::STRING) {
-                uint32_t len = val.length();
-                stats[c].minLength = min(stats[c].minLength, len);
-                stats[c].maxLength = max(stats[c].maxLength, len);
             }
         }
+
+        // 실제 데이터 행 작성
+        if (r > 0) json << ",";
+        json << "{";
+        for (int c = 0; c < numColumns; c++) {
+            if (c > 0) json << ",";
+            json << "\"" << job.escapedHeaders[c] << "\":";
+
+            const string& val = row[c];
+            // 타입별 값 처리 (Null, Number, Boolean, String)
+            if (TypeChecker::isNull(val)) {
+                json << "null";
+            } else if (rowParsed[c] && (columnTypes[c] == DataType::INTEGER || columnTypes[c] == DataType::FLOAT)) {
+                jsonSafeDouble(json, rowNumbers[c]);
+            } else if (rowParsed[c]) {
+                json << rowEpochs[c];
+            } else if (columnTypes[c] == DataType::BOOLEAN) {
+                char first = val.empty() ? '\0' : val[0];
+                if (first == 't' || first == 'T' || first == 'y' || first == 'Y' || first == '1') {
+                    json << "true";
+                } else if (first == 'f' || first == 'F' || first == 'n' || first == 'N' || first == '0') {
+                    json << "false";
+                } else {
+                    json << "\"" << escapeJson(val) << "\"";
+                }
+            } else {
+                json << "\"" << escapeJson(val) << "\"";
+            }
+        }
+        json << "}";
     }
 
-    // 최종 통계 정리 (고유값 개수 등)
+    chunk.json = json.str();
+
+    // 청크 내 중복 제거 후 파일 단위 고유값 집합에 병합
+    for (auto& hashes : chunkHashes) {
+        sort(hashes.begin(), hashes.end());
+        hashes.erase(unique(hashes.begin(), hashes.end()), hashes.end());
+    }
+    lock_guard<mutex> guard(job.uniqueLock);
+    for (int c = 0; c < numColumns; c++) {
+        mergeUniqueHashes(job.uniqueValHashes[c], chunkHashes[c]);
+    }
+}
+
+// 날짜/시간 값의 등간격 히스토그램 계산 (여러 파일의 값 목록을 한 번에 집계)
+static void writeHistogram(ostringstream& json, const vector<const vector<int64_t>*>& valueLists,
+                           int64_t minValue, int64_t maxValue) {
+    // 구간 너비는 전체 범위를 덮도록 올림 처리 (최소 1ms)
+    int64_t binWidth = (maxValue - minValue) / HISTOGRAM_BINS + 1;
+    vector<uint32_t> counts(HISTOGRAM_BINS, 0);
+    for (const auto* values : valueLists) {
+        for (int64_t value : *values) {
+            counts[(value - minValue) / binWidth]++;
+        }
+    }
+
+    json << ",\"histogram\":{\"start\":" << minValue;
+    json << ",\"binWidth\":" << binWidth;
+    json << ",\"counts\":[";
+    for (int i = 0; i < HISTOGRAM_BINS; i++) {
+        if (i > 0) json << ",";
+        json << counts[i];
+    }
+    json << "]}";
+}
+
+// 컬럼 통계 JSON 작성 (파일별/전체 통계 공용)
+// 날짜/시간 컬럼은 epoch 밀리초 범위와 히스토그램을 함께 작성
+static void writeColumnStats(ostringstream& json, const ColumnStats& stats, uint32_t rowCount,
+                             const vector<const vector<int64_t>*>& dateValueLists) {
+    json << "{\"count\":" << (rowCount - stats.nullCount);
+    json << ",\"unique\":" << stats.uniqueCount;
+    json << ",\"nullCount\":" << stats.nullCount;
+
+    if (stats.type == DataType::INTEGER || stats.type == DataType::FLOAT) {
+        // 타입에 맞지 않아 통계에서 제외된 값의 개수 (count = 통계 반영 값 + unparsedCount)
+        json << ",\"unparsedCount\":" << (rowCount - stats.nullCount - stats.count);
+        if (stats.count > 0) {
+            json << ",\"min\":"; jsonSafeDouble(json, stats.min);
+            json << ",\"max\":"; jsonSafeDouble(json, stats.max);
+            json << ",\"avg\":"; jsonSafeDouble(json, stats.mean);
+            json << ",\"std_dev\":"; jsonSafeDouble(json, getStdDev(stats));
+        }
+    } else if (isTemporalType(stats.type)) {
+        // histogram은 파싱된 값만 집계하므로 count = histogram 합계 + unparsedCount
+        json << ",\"unparsedCount\":" << (rowCount - stats.nullCount - stats.count);
+        if (stats.count > 0) {
+            int64_t minValue = (int64_t)stats.min;
+            int64_t maxValue = (int64_t)stats.max;
+            json << ",\"min\":" << minValue;
+            json << ",\"max\":" << maxValue;
+            writeHistogram(json, dateValueLists, minValue, maxValue);
+        }
+    } else if (stats.type == DataType::STRING) {
+        json << ",\"min_length\":" << (stats.minLength == UINT32_MAX ? 0 : stats.minLength);
+        json << ",\"max_length\":" << stats.maxLength;
+    }
+    json << "}";
+}
+
+// 3단계: 청크 결과 병합 후 파일 하나의 최종 JSON 작성
+static string buildFileJson(FileJob& job) {
+    const vector<string>& headers = job.parsed.headers;
+    if (headers.empty()) {
+        return "{\"error\":\"Empty CSV\",\"metadata\":{\"filename\":\"" + escapeJson(job.filename) + "\"}}";
+    }
+
+    const int numColumns = headers.size();
+    const int numRows = job.numRows;
+
+    // 청크별 통계 및 고유값 병합
+    job.stats.assign(numColumns, ColumnStats());
+    job.dateValues.assign(numColumns, vector<vector<int64_t>>());
     for (int i = 0; i < numColumns; i++) {
-        stats[i].uniqueCount = uniqueValHashes[i].size();
-        if (stats[i].minLength == UINT32_MAX) stats[i].minLength = 0;
+        job.stats[i].type = job.columnTypes[i];
+        if (isTemporalType(job.columnTypes[i])) job.dateValues[i].reserve(job.chunks.size());
+    }
+    size_t dataLength = 0;
+    for (auto& chunk : job.chunks) {
+        for (int i = 0; i < numColumns; i++) {
+            mergeStats(job.stats[i], chunk.stats[i]);
+            if (!chunk.dateValues[i].empty()) job.dateValues[i].push_back(move(chunk.dateValues[i]));
+        }
+        dataLength += chunk.json.length();
+    }
+    for (int i = 0; i < numColumns; i++) {
+        job.stats[i].uniqueCount = job.uniqueValHashes[i].size();
     }
 
     ostringstream json;
     json << fixed << setprecision(2);
 
-    // 메모리 할당 최적화 (예상 크기 예약)
-    size_t estimatedSize = content.length() * 1.5 + (numRows * numColumns * 20);
-    json.str().reserve(estimatedSize);
-
     // 메타데이터 작성
-    json << "{\"metadata\":{\"filename\":\"" << escapeJson(filename) << "\"";
+    json << "{\"metadata\":{\"filename\":\"" << escapeJson(job.filename) << "\"";
     json << ",\"totalRows\":" << numRows;
     json << ",\"totalColumns\":" << numColumns;
-    json << ",\"fileSizeBytes\":" << content.length();
+    json << ",\"fileSizeBytes\":" << job.fileSizeBytes;
     json << ",\"columns\":[";
 
     // 컬럼 정보 및 통계 작성
     for (int i = 0; i < numColumns; i++) {
         if (i > 0) json << ",";
-        json << "{\"name\":\"" << escapeJson(headers[i]) << "\"";
-        json << ",\"type\":\"" << dataTypeToString(columnTypes[i]) << "\"";
-        json << ",\"stats\":{\"count\":" << (numRows - stats[i].nullCount);
-        json << ",\"unique\":" << stats[i].uniqueCount;
-        json << ",\"nullCount\":" << stats[i].nullCount;
-
-        if (columnTypes[i] == DataType::INTEGER || columnTypes[i] == DataType::FLOAT) {
-            if (stats[i].count > 0) {
-                json << ",\"min\":"; jsonSafeDouble(json, stats[i].min);
-                json << ",\"max\":"; jsonSafeDouble(json, stats[i].max);
-                json << ",\"avg\":"; jsonSafeDouble(json, stats[i].mean);
-                json << ",\"std_dev\":"; jsonSafeDouble(json, getStdDev(stats[i]));
-            }
-        } else if (columnTypes[i] == DataType::STRING) {
-            json << ",\"min_length\":" << stats[i].minLength;
-            json << ",\"max_length\":" << stats[i].maxLength;
-        }
-        json << "}}";
+        json << "{\"name\":\"" << job.escapedHeaders[i] << "\"";
+        json << ",\"type\":\"" << dataTypeToString(job.columnTypes[i]) << "\"";
+        json << ",\"stats\":";
+        vector<const vector<int64_t>*> dateValueLists;
+        for (const auto& part : job.dateValues[i]) dateValueLists.push_back(&part);
+        writeColumnStats(json, job.stats[i], numRows, dateValueLists);
+        json << "}";
     }
 
     json << "]},\"data\":[";
 
-    // 헤더 이스케이프 미리 처리
-    vector<string> escapedHeaders(numColumns);
-    for (int i = 0; i < numColumns; i++) {
-        escapedHeaders[i] = escapeJson(headers[i]);
+    // 메모리 할당 최적화 (예상 크기 예약) 후 데이터 조각 이어 붙이기
+    string result = json.str();
+    result.reserve(result.length() + dataLength + 2);
+    for (auto& chunk : job.chunks) {
+        result += chunk.json;
+        string().swap(chunk.json);
     }
+    result += "]}";
 
-    // 실제 데이터 배열 작성
-    for (int r = 0; r < numRows; r++) {
-        if (r > 0) json << ",";
-        json << "{";
-        for (int c = 0; c < numColumns; c++) {
-            if (c > 0) json << ",";
-            json << "\"" << escapedHeaders[c] << "\":";
+    // 행 데이터는 더 이상 필요 없으므로 해제 (통계는 전체 통계 계산에 사용)
+    vector<vector<string>>().swap(job.parsed.rows);
+    vector<ChunkResult>().swap(job.chunks);
+    return result;
+}
 
-            const string& val = rows[r][c];
-            // 타입별 값 처리 (Null, Number, Boolean, String)
-            if (TypeChecker::isNull(val)) {
-                json << "null";
-            } else if (columnTypes[c] == DataType::INTEGER || columnTypes[c] == DataType::FLOAT) {
-                double num = stod(val);
-                jsonSafeDouble(json, num);
-            } else if (columnTypes[c] == DataType::BOOLEAN) {
-                char first = val.empty() ? '\0' : val[0];
-                if (first == 't' || first == 'T' || first == 'y' || first == 'Y' || first == '1') {
-                    json << "true";
-                } else if (first == 'f' || first == 'F' || first == 'n' || first == 'N' || first == '0') {
-                    json << "false";
-                } else {
-                    json << "\"" << escapeJson(val) << "\"";
-                }
+// 파일 목록 전체를 단계별로 스레드 풀에서 처리 (파일 간, 청크 간 작업 스틸링)
+static vector<string> runPipeline(vector<FileJob>& jobs, WorkStealingPool& pool) {
+    vector<function<void()>> tasks;
+
+    // 1단계: 파일별 파싱 및 타입 감지
+    tasks.reserve(jobs.size());
+    for (auto& job : jobs) {
+        tasks.push_back([&job] { prepareFile(job); });
+    }
+    pool.run(tasks);
+
+    // 여러 파일의 같은 이름 컬럼 타입 통일
+    if (jobs.size() > 1) unifyColumnTypes(jobs);
+
+    // 2단계: 모든 파일의 청크를 하나의 작업 목록으로 처리
+    tasks.clear();
+    for (auto& job : jobs) {
+        for (size_t i = 0; i < job.chunks.size(); i++) {
+            tasks.push_back([&job, i] { processChunk(job, i); });
+        }
+    }
+    pool.run(tasks);
+
+    // 3단계: 파일별 결과 병합 및 JSON 작성
+    vector<string> outputs(jobs.size());
+    tasks.clear();
+    for (size_t i = 0; i < jobs.size(); i++) {
+        tasks.push_back([&jobs, &outputs, i] { outputs[i] = buildFileJson(jobs[i]); });
+    }
+    pool.run(tasks);
+
+    return outputs;
+}
+
+// CSV 내용을 최적화된 방식으로 JSON으로 변환하는 메인 함수
+string convertToJsonOptimized(const string& csvContent, const string& filename) {
+    vector<FileJob> jobs(1);
+    jobs[0].csvContent = &csvContent;
+    jobs[0].filename = filename;
+
+    vector<string> outputs = runPipeline(jobs, WorkStealingPool::shared());
+    return outputs[0];
+}
+
+// 여러 CSV 파일을 한 번에 변환 (같은 이름의 컬럼은 타입 통일, 파일별 + 전체 통계 작성)
+string convertBatchToJson(const vector<string>& csvContents, const vector<string>& filenames) {
+    vector<FileJob> jobs(csvContents.size());
+    for (size_t i = 0; i < jobs.size(); i++) {
+        jobs[i].csvContent = &csvContents[i];
+        jobs[i].filename = i < filenames.size() ? filenames[i] : "";
+    }
+
+    vector<string> outputs = runPipeline(jobs, WorkStealingPool::shared());
+
+    // 전체 통계: 컬럼 이름별로 모든 파일의 통계 병합 (처음 나온 순서 유지)
+    vector<string> columnNames;
+    unordered_map<string, size_t> columnIndex;
+    vector<ColumnStats> combinedStats;
+    vector<unordered_set<size_t>> combinedHashes;
+    vector<vector<const vector<int64_t>*>> combinedDateValues;
+    vector<uint32_t> combinedRows;
+    vector<uint32_t> combinedFiles;
+    vector<bool> combinedTyped;             // 샘플 값이 있는 파일에서 타입을 정했는지
+    uint32_t totalRows = 0;
+    size_t totalBytes = 0;
+
+    for (const auto& job : jobs) {
+        totalBytes += job.fileSizeBytes;
+        if (job.parsed.headers.empty()) continue;
+
+        uint32_t numRows = job.numRows;
+        for (size_t c = 0; c < job.stats.size(); c++) {
+            const string& name = job.parsed.headers[c];
+            auto it = columnIndex.find(name);
+            size_t idx;
+            if (it == columnIndex.end()) {
+                idx = columnNames.size();
+                columnIndex.emplace(name, idx);
+                columnNames.push_back(name);
+                combinedStats.emplace_back();
+                combinedTyped.push_back(false);
+                combinedHashes.emplace_back();
+                combinedDateValues.emplace_back();
+                combinedRows.push_back(0);
+                combinedFiles.push_back(0);
             } else {
-                json << "\"" << escapeJson(val) << "\"";
+                idx = it->second;
             }
+            if (job.hasSampleValues[c]) {
+                combinedStats[idx].type = combinedTyped[idx]
+                    ? widenType(combinedStats[idx].type, job.columnTypes[c]) : job.columnTypes[c];
+                combinedTyped[idx] = true;
+            }
+            mergeStats(combinedStats[idx], job.stats[c]);
+            mergeUniqueHashes(combinedHashes[idx], job.uniqueValHashes[c]);
+            for (const auto& part : job.dateValues[c]) combinedDateValues[idx].push_back(&part);
+            combinedRows[idx] += numRows;
+            combinedFiles[idx]++;
         }
+        totalRows += numRows;
+    }
+
+    ostringstream json;
+    json << fixed << setprecision(2);
+
+    json << "{\"files\":[";
+    for (size_t i = 0; i < outputs.size(); i++) {
+        if (i > 0) json << ",";
+        json << outputs[i];
+        string().swap(outputs[i]);
+    }
+
+    json << "],\"combined\":{\"totalFiles\":" << jobs.size();
+    json << ",\"totalRows\":" << totalRows;
+    json << ",\"fileSizeBytes\":" << totalBytes;
+    json << ",\"columns\":[";
+    for (size_t i = 0; i < columnNames.size(); i++) {
+        combinedStats[i].uniqueCount = combinedHashes[i].size();
+
+        if (i > 0) json << ",";
+        json << "{\"name\":\"" << escapeJson(columnNames[i]) << "\"";
+        json << ",\"type\":\"" << dataTypeToString(combinedStats[i].type) << "\"";
+        json << ",\"files\":" << combinedFiles[i];
+        json << ",\"stats\":";
+        writeColumnStats(json, combinedStats[i], combinedRows[i], combinedDateValues[i]);
         json << "}";
     }
+    json << "]}}";
 
-    json << "]}";
     return json.str();
-}
\ No newline at end of file
+}
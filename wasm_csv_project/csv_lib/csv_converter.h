@@ -2,9 +2,11 @@
 #define CSV_CONVERTER_H
 
 #include <string>
+#include <vector>
 
 using namespace std;
 
 string convertToJsonOptimized(const string& csvContent, const string& filename);
+string convertBatchToJson(const vector<string>& csvContents, const vector<string>& filenames);
 
 #endif // CSV_CONVERTER_H
\ No newline at end of file
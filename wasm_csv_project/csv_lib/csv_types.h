@@ -13,6 +13,8 @@ enum class DataType {
     FLOAT,
     BOOLEAN,
     DATE,
+    DATETIME,
+    TIME,
     STRING
 };
 
@@ -0,0 +1,158 @@
+#include "date_parser.h"
+
+using namespace std;
+
+static const int64_t MILLIS_PER_SECOND = 1000;
+static const int64_t MILLIS_PER_MINUTE = 60 * MILLIS_PER_SECOND;
+static const int64_t MILLIS_PER_HOUR = 60 * MILLIS_PER_MINUTE;
+static const int64_t MILLIS_PER_DAY = 24 * MILLIS_PER_HOUR;
+
+// 고정 길이의 숫자 읽기 (숫자가 아닌 문자가 있으면 실패)
+static inline bool readDigits(const char* p, int count, int& out) {
+    int value = 0;
+    for (int i = 0; i < count; i++) {
+        unsigned digit = (unsigned char)p[i] - '0';
+        if (digit > 9) return false;
+        value = value * 10 + digit;
+    }
+    out = value;
+    return true;
+}
+
+static inline bool isLeapYear(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static bool isValidDate(int year, int month, int day) {
+    static const int daysInMonth[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month < 1 || month > 12 || day < 1) return false;
+    int maxDay = daysInMonth[month - 1] + (month == 2 && isLeapYear(year) ? 1 : 0);
+    return day <= maxDay;
+}
+
+// 1970-01-01 기준 일 수 (Howard Hinnant의 days_from_civil 알고리즘)
+static int64_t daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t yearOfEra = year - era * 400;
+    const int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+// 날짜 부분 파싱, 사용한 글자 수 반환 (실패 시 0)
+static size_t parseDatePart(const char* p, size_t len, int64_t& days) {
+    int year, month, day;
+    size_t used;
+
+    if (len >= 10 && (p[4] == '-' || p[4] == '/' || p[4] == '.') && p[7] == p[4]) {
+        // YYYY-MM-DD, YYYY/MM/DD, YYYY.MM.DD
+        if (!readDigits(p, 4, year) || !readDigits(p + 5, 2, month) || !readDigits(p + 8, 2, day)) return 0;
+        used = 10;
+    } else if (len >= 8 && (len == 8 || p[8] == 'T' || p[8] == ' ')) {
+        // YYYYMMDD (일반 정수와 구분하기 위해 연도 범위 제한)
+        if (!readDigits(p, 4, year) || !readDigits(p + 4, 2, month) || !readDigits(p + 6, 2, day)) return 0;
+        if (year < 1900 || year > 2100) return 0;
+        used = 8;
+    } else {
+        return 0;
+    }
+
+    if (!isValidDate(year, month, day)) return 0;
+    days = daysFromCivil(year, month, day);
+    return used;
+}
+
+// 시간 부분 파싱 (HH:MM[:SS[.fff]]), 사용한 글자 수 반환 (실패 시 0)
+static size_t parseTimePart(const char* p, size_t len, int64_t& millis) {
+    int hour, minute, second = 0, fraction = 0;
+    if (len < 5 || p[2] != ':') return 0;
+    if (!readDigits(p, 2, hour) || !readDigits(p + 3, 2, minute)) return 0;
+    if (hour > 23 || minute > 59) return 0;
+    size_t used = 5;
+
+    if (used < len && p[used] == ':') {
+        if (len < used + 3 || !readDigits(p + used + 1, 2, second) || second > 59) return 0;
+        used += 3;
+
+        // 소수점 이하 초 (밀리초까지만 사용)
+        if (used < len && (p[used] == '.' || p[used] == ',')) {
+            size_t start = ++used;
+            int scale = 100;
+            while (used < len && (unsigned)((unsigned char)p[used] - '0') <= 9) {
+                fraction += (p[used] - '0') * scale;
+                scale /= 10;
+                used++;
+            }
+            if (used == start) return 0;
+        }
+    }
+
+    millis = hour * MILLIS_PER_HOUR + minute * MILLIS_PER_MINUTE + second * MILLIS_PER_SECOND + fraction;
+    return used;
+}
+
+// 시간대 오프셋 파싱 (Z, ±HH, ±HHMM, ±HH:MM), 문자열 끝까지 정확히 일치해야 성공
+static bool parseOffset(const char* p, size_t len, int64_t& offsetMillis) {
+    if (len == 1 && (p[0] == 'Z' || p[0] == 'z')) {
+        offsetMillis = 0;
+        return true;
+    }
+    if (p[0] != '+' && p[0] != '-') return false;
+
+    int hour, minute = 0;
+    if (len < 3 || !readDigits(p + 1, 2, hour)) return false;
+    if (len == 5) {
+        if (!readDigits(p + 3, 2, minute)) return false;
+    } else if (len == 6) {
+        if (p[3] != ':' || !readDigits(p + 4, 2, minute)) return false;
+    } else if (len != 3) {
+        return false;
+    }
+    if (hour > 23 || minute > 59) return false;
+
+    offsetMillis = hour * MILLIS_PER_HOUR + minute * MILLIS_PER_MINUTE;
+    if (p[0] == '-') offsetMillis = -offsetMillis;
+    return true;
+}
+
+bool parseDateTime(const string& str, int64_t& epochMillis, DataType& type) {
+    const size_t len = str.length();
+    // 최적화: 가장 짧은 형식은 HH:MM(5), 가장 긴 형식은 오프셋 포함 ISO 날짜시간
+    if (len < 5 || len > 35) return false;
+    const char* p = str.data();
+
+    // 시간만 있는 경우 (HH:MM[:SS])
+    if (p[2] == ':') {
+        int64_t millis;
+        if (parseTimePart(p, len, millis) != len) return false;
+        epochMillis = millis;
+        type = DataType::TIME;
+        return true;
+    }
+
+    int64_t days;
+    size_t pos = parseDatePart(p, len, days);
+    if (pos == 0) return false;
+    if (pos == len) {
+        epochMillis = days * MILLIS_PER_DAY;
+        type = DataType::DATE;
+        return true;
+    }
+
+    // 날짜와 시간 사이 구분자
+    if (p[pos] != 'T' && p[pos] != ' ') return false;
+    pos++;
+
+    int64_t millis;
+    size_t used = parseTimePart(p + pos, len - pos, millis);
+    if (used == 0) return false;
+    pos += used;
+
+    int64_t offsetMillis = 0;
+    if (pos < len && !parseOffset(p + pos, len - pos, offsetMillis)) return false;
+
+    epochMillis = days * MILLIS_PER_DAY + millis - offsetMillis;
+    type = DataType::DATETIME;
+    return true;
+}
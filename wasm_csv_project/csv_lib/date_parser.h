@@ -0,0 +1,16 @@
+#ifndef DATE_PARSER_H
+#define DATE_PARSER_H
+
+#include <string>
+#include <cstdint>
+#include "csv_types.h" // For DataType
+
+using namespace std;
+
+// 고정 형식의 날짜/시간 문자열을 epoch 밀리초(UTC)로 변환
+// 지원 형식: YYYY-MM-DD, YYYY/MM/DD, YYYY.MM.DD, YYYYMMDD, HH:MM[:SS[.fff]],
+//           날짜 + ('T' 또는 ' ') + 시간 [+ Z, ±HH, ±HHMM, ±HH:MM]
+// 성공 시 type에 DATE, DATETIME, TIME 중 하나를 저장 (TIME은 자정 기준 밀리초)
+bool parseDateTime(const string& str, int64_t& epochMillis, DataType& type);
+
+#endif // DATE_PARSER_H
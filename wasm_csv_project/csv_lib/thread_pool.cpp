@@ -0,0 +1,132 @@
+#include "thread_pool.h"
+
+using namespace std;
+
+WorkStealingPool::WorkStealingPool(size_t numThreads) {
+    if (numThreads == 0) numThreads = 1;
+
+    for (size_t i = 0; i < numThreads; i++) {
+        queues.push_back(make_unique<WorkerQueue>());
+    }
+
+    // 호출 스레드가 0번 큐를 맡으므로 나머지 개수만큼만 스레드 생성
+    workers.reserve(numThreads - 1);
+    for (size_t i = 1; i < numThreads; i++) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        lock_guard<mutex> guard(stateLock);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// 사용 가능한 코어 수 (스레드 미지원 WASM 빌드에서는 1)
+size_t WorkStealingPool::defaultThreadCount() {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    return 1;
+#else
+    size_t cores = thread::hardware_concurrency();
+    return cores > 0 ? cores : 1;
+#endif
+}
+
+WorkStealingPool& WorkStealingPool::shared() {
+    static WorkStealingPool pool(defaultThreadCount());
+    return pool;
+}
+
+void WorkStealingPool::run(vector<function<void()>>& tasks) {
+    if (tasks.empty()) return;
+    lock_guard<mutex> runGuard(runLock);
+
+    // 작업을 라운드 로빈으로 각 큐에 분배
+    for (size_t i = 0; i < tasks.size(); i++) {
+        WorkerQueue& queue = *queues[i % queues.size()];
+        lock_guard<mutex> guard(queue.lock);
+        queue.tasks.push_back(&tasks[i]);
+    }
+
+    {
+        lock_guard<mutex> guard(stateLock);
+        generation++;
+        activeWorkers = workers.size();
+    }
+    wakeCondition.notify_all();
+
+    drain(0);
+
+    {
+        unique_lock<mutex> guard(stateLock);
+        doneCondition.wait(guard, [this] { return activeWorkers == 0; });
+    }
+
+    exception_ptr error;
+    {
+        lock_guard<mutex> guard(errorLock);
+        error = firstError;
+        firstError = nullptr;
+    }
+    if (error) rethrow_exception(error);
+}
+
+// 자기 큐의 뒤쪽(가장 최근 작업)에서 꺼냄
+bool WorkStealingPool::popLocal(size_t index, function<void()>*& task) {
+    WorkerQueue& queue = *queues[index];
+    lock_guard<mutex> guard(queue.lock);
+    if (queue.tasks.empty()) return false;
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    return true;
+}
+
+// 다른 큐의 앞쪽(가장 오래된 작업)에서 훔쳐 옴
+bool WorkStealingPool::steal(size_t thief, function<void()>*& task) {
+    for (size_t offset = 1; offset < queues.size(); offset++) {
+        WorkerQueue& victim = *queues[(thief + offset) % queues.size()];
+        lock_guard<mutex> guard(victim.lock);
+        if (victim.tasks.empty()) continue;
+        task = victim.tasks.front();
+        victim.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+// 모든 큐가 빌 때까지 작업 실행 (작업이 새 작업을 만들지 않으므로 모두 비면 종료)
+void WorkStealingPool::drain(size_t index) {
+    function<void()>* task = nullptr;
+    while (popLocal(index, task) || steal(index, task)) {
+        try {
+            (*task)();
+        } catch (...) {
+            lock_guard<mutex> guard(errorLock);
+            if (!firstError) firstError = current_exception();
+        }
+    }
+}
+
+void WorkStealingPool::workerLoop(size_t index) {
+    uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            unique_lock<mutex> guard(stateLock);
+            wakeCondition.wait(guard, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = generation;
+        }
+
+        drain(index);
+
+        {
+            lock_guard<mutex> guard(stateLock);
+            if (--activeWorkers == 0) doneCondition.notify_all();
+        }
+    }
+}
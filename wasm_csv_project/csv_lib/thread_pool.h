@@ -0,0 +1,60 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <cstdint>
+
+using namespace std;
+
+// 워크 스틸링(work-stealing) 스레드 풀
+// 스레드마다 자기 작업 큐를 가지며, 자기 큐가 비면 다른 스레드의 큐에서 작업을 훔쳐 옵니다.
+// 스레드는 한 번만 생성되어 여러 번의 run() 호출에서 재사용됩니다.
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(size_t numThreads);
+    ~WorkStealingPool();
+
+    // 작업 목록을 모두 실행하고 끝날 때까지 대기 (호출 스레드도 작업에 참여)
+    // 작업 중 발생한 첫 번째 예외는 모든 작업이 끝난 뒤 호출 스레드에서 다시 던집니다.
+    void run(vector<function<void()>>& tasks);
+
+    size_t size() const { return queues.size(); }
+
+    // 프로세스 전체에서 공유하는 기본 풀 (최초 사용 시 생성)
+    static WorkStealingPool& shared();
+    static size_t defaultThreadCount();
+
+private:
+    struct WorkerQueue {
+        mutex lock;
+        deque<function<void()>*> tasks;
+    };
+
+    bool popLocal(size_t index, function<void()>*& task);
+    bool steal(size_t thief, function<void()>*& task);
+    void drain(size_t index);
+    void workerLoop(size_t index);
+
+    vector<unique_ptr<WorkerQueue>> queues; // 0번 큐는 run()을 호출한 스레드용
+    vector<thread> workers;
+
+    mutex runLock;                          // run() 동시 호출 방지
+    mutex stateLock;
+    condition_variable wakeCondition;
+    condition_variable doneCondition;
+    uint64_t generation = 0;                // run() 호출마다 증가
+    size_t activeWorkers = 0;
+    bool stopping = false;
+
+    mutex errorLock;
+    exception_ptr firstError;
+};
+
+#endif // THREAD_POOL_H
@@ -1,4 +1,5 @@
 #include "type_checker.h"
+#include "date_parser.h"
 #include <algorithm>
 #include <cmath>
 #include <cerrno>
@@ -65,14 +66,11 @@ bool TypeChecker::isBoolean(const string& str) {
            str == "1" || str == "0";
 }
 
-// 날짜 판별
+// 날짜 판별 (날짜 또는 날짜+시간, 실제 달력상 유효한 값만 허용)
 bool TypeChecker::isDate(const string& str) {
-    // YYYYMMDD(8) ~ YYYY-MM-DD(10) 형식만 간단히 검사
-    if (str.length() < 8 || str.length() > 10) return false; 
-    if (str.length() == 10) {
-        return (str[4] == '-' || str[4] == '/') && (str[7] == '-' || str[7] == '/');
-    }
-    return false;
+    int64_t epochMillis;
+    DataType type;
+    return parseDateTime(str, epochMillis, type) && type != DataType::TIME;
 }
 
 // NULL 판별